@@ -1,3 +1,5 @@
+#pragma once
+
 #include <iostream>
 #include <cassert>
 
@@ -21,7 +23,7 @@ namespace bmstu {
         struct list_iterator {
             friend class list;
 
-            using iterator_category = std::random_access_iterator_tag;
+            using iterator_category = std::bidirectional_iterator_tag;
             using difference_type = std::ptrdiff_t;
             using value_type = value_t;
             using pointer = value_t *;
@@ -112,15 +114,16 @@ namespace bmstu {
                 return copy;
             }
 
-            list_iterator operator+=(const difference_type value) noexcept {
-                return ((*this) + value);
+            list_iterator &operator+=(const difference_type value) noexcept {
+                *this = (*this) + value;
+                return *this;
             }
 
             friend difference_type operator-(const list_iterator &end, const list_iterator &begin) {
                 difference_type result{};
                 list_iterator copy(begin);
                 for (result = 0; copy != end; ++result) {
-                    copy +=1;
+                    ++copy;
                 }
                 return result;
             }
@@ -300,11 +303,11 @@ namespace bmstu {
 
         friend std::ostream &operator<<(std::ostream &os, const list<T> &other) {
             os << "{";
-            if (other.size_) {
-                for (int i = 0; i < other.size_ - 1; ++i) {
-                    os << other[i] << ", ";
+            for (auto it = other.begin(); it != other.end(); ++it) {
+                if (it != other.begin()) {
+                    os << ", ";
                 }
-                os << other[other.size_ - 1];
+                os << *it;
             }
             os << "}";
             return os;
@@ -332,9 +335,10 @@ namespace bmstu {
                 return;
             } else {
                 iterator it_b = begin();
-                iterator it_e = end()-1;
-                for(;it_b!=it_e && it_b!=(it_e-1); ++it_b, --it_e) {
+                iterator it_e = end();
+                while (it_b != it_e && it_b != --it_e) {
                     std::swap(*it_b, *it_e);
+                    ++it_b;
                 }
             }
         }
@@ -421,13 +425,31 @@ namespace bmstu {
 
         /// Оператор "дописи" другого списка к текущему
         list<T> &operator+=(const list<T> &other) {
-            for (const auto &item: other) {
-                this->push_back(item);
+            auto it = other.begin();
+            for (size_t i = other.size_; i > 0; --i, ++it) {
+                this->push_back(*it);
             }
-            size_ += other.size_;
             return *this;
         }
 
+        /// Перенос всех узлов другого списка в конец текущего за O(1), other становится пустым
+        void splice_back(list<T> &other) noexcept {
+            if (this == &other || other.empty()) {
+                return;
+            }
+            node *first = other.head_->next_node;
+            node *last = other.tail_->prev_node;
+            first->prev_node = tail_->prev_node;
+            tail_->prev_node->next_node = first;
+            last->next_node = tail_;
+            tail_->prev_node = last;
+            size_ += other.size_;
+
+            other.head_->next_node = other.tail_;
+            other.tail_->prev_node = other.head_;
+            other.size_ = 0;
+        }
+
         /// Оператор конкатенации списков
         friend list<T> operator+(const list<T> &left, const list<T> &right) {
             list<T> result(left);
@@ -448,7 +470,7 @@ namespace bmstu {
                     return false;
                 }
             }
-            return (fr == right.end()) && (fl == left.end());
+            return (fl == left.end()) && (fr != right.end());
         }
 
         size_t size_ = 0;
@@ -0,0 +1,218 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "bmstu_list.h"
+
+namespace bmstu {
+    /// Список для добавления из многих потоков. Поток при первом push_back в конкретный список
+    /// получает свободный шард этого списка и держит его до своего завершения, после чего шард
+    /// возвращается. Пока живых добавляющих потоков не больше shards(), у каждого свой шард
+    /// и его мьютекс никто не оспаривает. Если потоков больше, лишние делят наименее занятые
+    /// шарды, и мьютекс шарда превращается в обычную блокировку - это сознательная плата
+    /// за отсутствие ограничения на число потоков. Порядок элементов между потоками не сохраняется
+    template<typename T>
+    class sharded_list {
+        struct alignas(64) shard {
+            std::mutex mutex_;
+            list<T> items_;
+        };
+
+        /// Сколько живых потоков закреплено за каждым шардом
+        struct registry {
+            explicit registry(size_t shards) : owners_(shards, 0) {}
+
+            std::mutex mutex_;
+            std::vector<size_t> owners_;
+        };
+
+        /// Закрепления текущего потока за шардами разных списков; id уникален на весь процесс,
+        /// поэтому новый список по старому адресу не подхватит чужую запись
+        struct lease {
+            uint64_t id_;
+            size_t shard_;
+            std::weak_ptr<registry> registry_;
+        };
+
+        struct thread_leases {
+            ~thread_leases() {
+                for (auto &item: leases_) {
+                    release_(item);
+                }
+            }
+
+            std::vector<lease> leases_;
+            size_t last_ = 0;
+        };
+
+    public:
+        using value_type = T;
+
+        explicit sharded_list(size_t shards = default_shards())
+                : shards_count_(std::max<size_t>(shards, 1)), shards_(new shard[shards_count_]),
+                  registry_(std::make_shared<registry>(shards_count_)), id_(next_id_()) {}
+
+        sharded_list(const sharded_list &) = delete;
+
+        sharded_list &operator=(const sharded_list &) = delete;
+
+        /// Добавление в шард текущего потока
+        template<typename Type>
+        void push_back(const Type &value) {
+            shard &own = shards_[own_shard_()];
+            std::lock_guard<std::mutex> lock(own.mutex_);
+            own.items_.push_back(value);
+        }
+
+        /// O(shards)
+        size_t size() const {
+            size_t result = 0;
+            for (size_t i = 0; i < shards_count_; ++i) {
+                std::lock_guard<std::mutex> lock(shards_[i].mutex_);
+                result += shards_[i].items_.size();
+            }
+            return result;
+        }
+
+        bool empty() const {
+            return size() == 0u;
+        }
+
+        size_t shards() const noexcept {
+            return shards_count_;
+        }
+
+        void clear() {
+            for (size_t i = 0; i < shards_count_; ++i) {
+                std::lock_guard<std::mutex> lock(shards_[i].mutex_);
+                shards_[i].items_.clear();
+            }
+        }
+
+        /// Склейка всех шардов в один список за O(shards), шарды остаются пустыми
+        list<T> collect() {
+            list<T> result;
+            for (size_t i = 0; i < shards_count_; ++i) {
+                std::lock_guard<std::mutex> lock(shards_[i].mutex_);
+                result.splice_back(shards_[i].items_);
+            }
+            return result;
+        }
+
+        /// Параллельный обход: каждый непустой шард обходится в своём потоке под мьютексом шарда,
+        /// первый непустой - в вызывающем потоке, для пустых потоки не создаются.
+        /// Первое исключение из func пробрасывается после завершения всех потоков.
+        /// Пока шард обходится, push_back в него из других потоков ждёт на мьютексе.
+        /// func не должна вызывать методы этого же списка - шарды заблокированы, будет дедлок
+        template<typename Func>
+        void for_each(Func func) {
+            std::vector<std::thread> workers;
+            std::vector<std::exception_ptr> errors(shards_count_);
+            auto visit = [this, &func, &errors](size_t i) {
+                try {
+                    std::lock_guard<std::mutex> lock(shards_[i].mutex_);
+                    for (auto &item: shards_[i].items_) {
+                        func(item);
+                    }
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            };
+            auto join_all = [&workers] {
+                for (auto &worker: workers) {
+                    worker.join();
+                }
+            };
+            size_t inline_shard = shards_count_;
+            try {
+                for (size_t i = 0; i < shards_count_; ++i) {
+                    if (shard_empty_(i)) {
+                        continue;
+                    }
+                    if (inline_shard == shards_count_) {
+                        inline_shard = i;
+                    } else {
+                        workers.emplace_back(visit, i);
+                    }
+                }
+            } catch (...) {
+                join_all();
+                throw;
+            }
+            if (inline_shard != shards_count_) {
+                visit(inline_shard);
+            }
+            join_all();
+            for (const auto &error: errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+        }
+
+    private:
+        static size_t default_shards() noexcept {
+            return std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        bool shard_empty_(size_t i) const {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex_);
+            return shards_[i].items_.empty();
+        }
+
+        static uint64_t next_id_() noexcept {
+            static std::atomic<uint64_t> next_id{0};
+            return next_id.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /// Шард текущего потока; быстрый путь - последнее использованное закрепление
+        size_t own_shard_() {
+            thread_local thread_leases leases;
+            if (leases.last_ < leases.leases_.size() && leases.leases_[leases.last_].id_ == id_) {
+                return leases.leases_[leases.last_].shard_;
+            }
+            for (size_t i = 0; i < leases.leases_.size(); ++i) {
+                if (leases.leases_[i].id_ == id_) {
+                    leases.last_ = i;
+                    return leases.leases_[i].shard_;
+                }
+            }
+            /// Записи уже уничтоженных списков больше не нужны
+            for (size_t i = leases.leases_.size(); i-- > 0;) {
+                if (leases.leases_[i].registry_.expired()) {
+                    leases.leases_.erase(leases.leases_.begin() + i);
+                }
+            }
+            leases.leases_.push_back(lease{id_, acquire_(), registry_});
+            leases.last_ = leases.leases_.size() - 1;
+            return leases.leases_.back().shard_;
+        }
+
+        /// Самый свободный шард (незанятый, если такой есть)
+        size_t acquire_() {
+            std::lock_guard<std::mutex> lock(registry_->mutex_);
+            auto &owners = registry_->owners_;
+            size_t best = std::min_element(owners.begin(), owners.end()) - owners.begin();
+            ++owners[best];
+            return best;
+        }
+
+        static void release_(const lease &item) {
+            if (auto owner = item.registry_.lock()) {
+                std::lock_guard<std::mutex> lock(owner->mutex_);
+                --owner->owners_[item.shard_];
+            }
+        }
+
+        size_t shards_count_;
+        std::unique_ptr<shard[]> shards_;
+        std::shared_ptr<registry> registry_;
+        uint64_t id_;
+    };
+}
@@ -0,0 +1,479 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace bmstu {
+    /// Отсортированный список на skip-list: нижний уровень - обычный двусвязный список
+    /// (по нему ходят итераторы), верхние уровни - односвязные "экспресс" ссылки.
+    /// insert, find, erase, lower_bound и upper_bound работают за ожидаемое O(log n).
+    /// Равные элементы допускаются и хранятся в порядке вставки.
+    /// Узел и его ссылки верхних уровней лежат в одном выделении памяти, ссылка нижнего уровня
+    /// хранится в самом узле. Сторожевые узлы встроены в объект, поэтому перемещение не выделяет память.
+    /// Сторожевые узлы содержат только ссылки, без T, так что T не обязан конструироваться по умолчанию
+    template<typename T, typename Compare = std::less<T>>
+    class sorted_list {
+        static constexpr size_t kMaxLevel = 32;
+
+        /// Ссылки узла; сторожевые узлы - это только они
+        struct node_base {
+            node_base() = default;
+
+            node_base(size_t level, node_base **upper) : level_(level), upper_nodes(upper) {}
+
+            /// Ссылка уровня i; нижний уровень лежит в узле, чтобы шаг итератора был одной загрузкой
+            node_base *&next(size_t i) noexcept {
+                return (i == 0) ? next_node : upper_nodes[i - 1];
+            }
+
+            node_base *next_node = nullptr;
+            node_base *prev_node = nullptr;
+            size_t level_ = 1;
+            node_base **upper_nodes = nullptr;
+        };
+
+        struct node : node_base {
+            node(const T &value, size_t level, node_base **upper) : node_base(level, upper), value_(value) {}
+
+            T value_;
+        };
+
+    public:
+        /// Значения менять через итератор нельзя, иначе нарушится порядок
+        struct list_iterator {
+            friend class sorted_list;
+
+            using iterator_category = std::bidirectional_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = T;
+            using pointer = const T *;
+            using reference = const T &;
+
+            list_iterator() = default;
+
+            list_iterator(node_base *node) : node_(node) {}
+
+            reference operator*() const {
+                return value_of_(node_);
+            }
+
+            pointer operator->() const {
+                return &value_of_(node_);
+            }
+
+            list_iterator &operator++() {
+                if (node_->next_node == nullptr) {
+                    throw std::logic_error("You can't access the element after tail!");
+                }
+                node_ = node_->next_node;
+                return *this;
+            }
+
+            list_iterator &operator--() {
+                if (node_->prev_node == nullptr) {
+                    throw std::logic_error("You can't access the element before head!");
+                }
+                node_ = node_->prev_node;
+                return *this;
+            }
+
+            list_iterator operator++(int) {
+                list_iterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            list_iterator operator--(int) {
+                list_iterator tmp = *this;
+                --(*this);
+                return tmp;
+            }
+
+            friend bool operator==(const list_iterator &a, const list_iterator &b) {
+                return a.node_ == b.node_;
+            }
+
+            friend bool operator!=(const list_iterator &a, const list_iterator &b) {
+                return !(a == b);
+            }
+
+        private:
+            node_base *node_ = nullptr;
+        };
+
+        using value_type = T;
+        using reference = const value_type &;
+        using const_reference = const value_type &;
+        using iterator = list_iterator;
+        using const_iterator = list_iterator;
+
+        explicit sorted_list(const Compare &comp = Compare()) : comp_(comp), random_(seed_()) {
+            head_.level_ = kMaxLevel;
+            head_.upper_nodes = head_upper_nodes_;
+            reset_sentinels_();
+        }
+
+        template<typename it>
+        sorted_list(it begin, it end, const Compare &comp = Compare()) : sorted_list(comp) {
+            for (it copy(begin); copy != end; ++copy) {
+                insert(*copy);
+            }
+        }
+
+        sorted_list(std::initializer_list<T> values, const Compare &comp = Compare()) : sorted_list(comp) {
+            for (const auto &val: values) {
+                insert(val);
+            }
+        }
+
+        /// Копия собирается добавлением в конец за O(n), без поиска позиций
+        sorted_list(const sorted_list &other) : sorted_list(other.comp_) {
+            node_base *last[kMaxLevel];
+            for (size_t i = 0; i < kMaxLevel; ++i) {
+                last[i] = &head_;
+            }
+            for (const auto &item: other) {
+                size_t level = random_level_();
+                node *new_node = create_node_(item, level);
+                for (size_t i = 0; i < level; ++i) {
+                    new_node->next(i) = &tail_;
+                    last[i]->next(i) = new_node;
+                    last[i] = new_node;
+                }
+                new_node->prev_node = tail_.prev_node;
+                tail_.prev_node = new_node;
+                level_ = std::max(level_, level);
+                ++size_;
+            }
+        }
+
+        /// O(log n) ожидаемо: перевешиваются только ссылки на сторожевые узлы, other остаётся пустым
+        sorted_list(sorted_list &&other) noexcept : sorted_list(other.comp_) {
+            steal_(other);
+        }
+
+        sorted_list &operator=(const sorted_list &other) {
+            if (this != &other) {
+                sorted_list tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        sorted_list &operator=(sorted_list &&other) noexcept {
+            if (this != &other) {
+                clear();
+                comp_ = other.comp_;
+                steal_(other);
+            }
+            return *this;
+        }
+
+        ~sorted_list() {
+            clear();
+        }
+
+        /// Вставка после всех равных value, возвращает итератор на новый элемент
+        iterator insert(const T &value) {
+            node_base *update[kMaxLevel];
+            find_predecessors_(value, update, true);
+            size_t level = random_level_();
+            node *new_node = create_node_(value, level);
+            for (size_t i = 0; i < level; ++i) {
+                new_node->next(i) = update[i]->next(i);
+                update[i]->next(i) = new_node;
+            }
+            new_node->prev_node = update[0];
+            new_node->next_node->prev_node = new_node;
+            level_ = std::max(level_, level);
+            ++size_;
+            return iterator{new_node};
+        }
+
+        /// Первый элемент, не меньший value
+        iterator lower_bound(const T &value) const {
+            node_base *update[kMaxLevel];
+            find_predecessors_(value, update, false);
+            return iterator{update[0]->next_node};
+        }
+
+        /// Первый элемент, больший value
+        iterator upper_bound(const T &value) const {
+            node_base *update[kMaxLevel];
+            find_predecessors_(value, update, true);
+            return iterator{update[0]->next_node};
+        }
+
+        /// Первый элемент, равный value, или end()
+        iterator find(const T &value) const {
+            iterator it = lower_bound(value);
+            if (it == end() || comp_(value, *it)) {
+                return end();
+            }
+            return it;
+        }
+
+        bool contains(const T &value) const {
+            return find(value) != end();
+        }
+
+        /// Удаление всех элементов, равных value, возвращает их количество
+        size_t erase(const T &value) {
+            size_t before = size_;
+            remove(lower_bound(value), upper_bound(value));
+            return before - size_;
+        }
+
+        /// Удаление элемента, возвращает итератор на следующий
+        iterator erase(const_iterator pos) {
+            if (pos == end()) {
+                throw std::logic_error("You can't erase end");
+            }
+            iterator next = pos;
+            ++next;
+            remove(pos, next);
+            return next;
+        }
+
+        /// Удаление элементов [it_b, it_e): O(log n) на поиск соседей плюс O(1) ожидаемо на элемент
+        void remove(const_iterator it_b, const_iterator it_e) {
+            if (it_b == it_e) {
+                return;
+            }
+            node_base *update[kMaxLevel];
+            find_node_predecessors_(it_b.node_, update);
+            while (it_b != it_e) {
+                node_base *current = it_b.node_;
+                ++it_b;
+                for (size_t i = 0; i < current->level_; ++i) {
+                    update[i]->next(i) = current->next(i);
+                }
+                destroy_node_(current);
+                --size_;
+            }
+            it_e.node_->prev_node = update[0];
+            shrink_level_();
+        }
+
+        void clear() noexcept {
+            node_base *current = head_.next_node;
+            while (current != &tail_) {
+                node_base *next = current->next_node;
+                destroy_node_(current);
+                current = next;
+            }
+            reset_sentinels_();
+        }
+
+        bool empty() const noexcept {
+            return (size_ == 0u);
+        }
+
+        size_t size() const noexcept {
+            return size_;
+        }
+
+        void swap(sorted_list &other) noexcept {
+            sorted_list tmp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(tmp);
+        }
+
+        friend void swap(sorted_list &l, sorted_list &r) {
+            l.swap(r);
+        }
+
+        iterator begin() const noexcept {
+            return iterator{head_.next_node};
+        }
+
+        iterator end() const noexcept {
+            return iterator{const_cast<node_base *>(&tail_)};
+        }
+
+        iterator cbegin() const noexcept {
+            return begin();
+        }
+
+        iterator cend() const noexcept {
+            return end();
+        }
+
+        friend bool operator==(const sorted_list &l, const sorted_list &r) {
+            if (l.size_ != r.size_) {
+                return false;
+            }
+            for (auto l_b = l.begin(), r_b = r.begin(); l_b != l.end(); ++l_b, ++r_b) {
+                if (*l_b != *r_b) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        friend bool operator!=(const sorted_list &left, const sorted_list &right) {
+            return !(left == right);
+        }
+
+        friend std::ostream &operator<<(std::ostream &os, const sorted_list &other) {
+            os << "{";
+            for (auto it = other.begin(); it != other.end(); ++it) {
+                if (it != other.begin()) {
+                    os << ", ";
+                }
+                os << *it;
+            }
+            os << "}";
+            return os;
+        }
+
+    private:
+        /// update[i] - последний узел уровня i, меньший value (или не больший, если inclusive)
+        void find_predecessors_(const T &value, node_base **update, bool inclusive) const {
+            node_base *current = const_cast<node_base *>(&head_);
+            for (size_t i = kMaxLevel; i-- > 0;) {
+                if (i < level_) {
+                    node_base *next = current->next(i);
+                    while (next != &tail_ &&
+                           (inclusive ? !comp_(value, value_of_(next)) : comp_(value_of_(next), value))) {
+                        current = next;
+                        next = current->next(i);
+                    }
+                }
+                update[i] = current;
+            }
+        }
+
+        /// Предшественники конкретного узла: среди равных значений доходим до него по нижнему уровню
+        void find_node_predecessors_(node_base *target, node_base **update) const {
+            find_predecessors_(value_of_(target), update, false);
+            for (node_base *current = update[0]->next_node; current != target; current = current->next_node) {
+                for (size_t i = 0; i < current->level_; ++i) {
+                    update[i] = current;
+                }
+            }
+        }
+
+        void shrink_level_() noexcept {
+            while (level_ > 1 && head_.next(level_ - 1) == &tail_) {
+                --level_;
+            }
+        }
+
+        void reset_sentinels_() noexcept {
+            for (size_t i = 0; i < kMaxLevel; ++i) {
+                head_.next(i) = &tail_;
+            }
+            tail_.prev_node = &head_;
+            size_ = 0;
+            level_ = 1;
+        }
+
+        /// Забирает узлы other (this пуст): последние узлы каждого уровня ищутся спуском сверху
+        void steal_(sorted_list &other) noexcept {
+            if (other.empty()) {
+                return;
+            }
+            node_base *last = &other.head_;
+            for (size_t i = other.level_; i-- > 0;) {
+                while (last->next(i) != &other.tail_) {
+                    last = last->next(i);
+                }
+                if (last != &other.head_) {
+                    head_.next(i) = other.head_.next(i);
+                    last->next(i) = &tail_;
+                }
+            }
+            head_.next_node->prev_node = &head_;
+            tail_.prev_node = last;
+            size_ = other.size_;
+            level_ = other.level_;
+            other.reset_sentinels_();
+        }
+
+        /// Значение узла, не являющегося сторожевым
+        static const T &value_of_(node_base *target) noexcept {
+            return static_cast<node *>(target)->value_;
+        }
+
+        /// Узел и массив его верхних ссылок - одно выделение памяти
+        static node *create_node_(const T &value, size_t level) {
+            void *raw = allocate_(sizeof(node) + (level - 1) * sizeof(node_base *));
+            node_base **upper = reinterpret_cast<node_base **>(static_cast<char *>(raw) + sizeof(node));
+            try {
+                return new(raw) node(value, level, upper);
+            } catch (...) {
+                deallocate_(raw);
+                throw;
+            }
+        }
+
+        static void destroy_node_(node_base *target) noexcept {
+            static_cast<node *>(target)->~node();
+            deallocate_(static_cast<node *>(target));
+        }
+
+        /// Обычный operator new гарантирует только __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+        /// для T с большим выравниванием нужна выравнивающая перегрузка
+        static constexpr bool kOverAligned = alignof(node) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+        static void *allocate_(size_t bytes) {
+            if constexpr (kOverAligned) {
+                return ::operator new(bytes, std::align_val_t{alignof(node)});
+            } else {
+                return ::operator new(bytes);
+            }
+        }
+
+        static void deallocate_(void *raw) noexcept {
+            if constexpr (kOverAligned) {
+                ::operator delete(raw, std::align_val_t{alignof(node)});
+            } else {
+                ::operator delete(raw);
+            }
+        }
+
+        /// Зерно своё у каждого экземпляра (адрес и порядковый номер), чтобы разные списки
+        /// и копии не повторяли одну и ту же последовательность уровней
+        uint64_t seed_() const noexcept {
+            static std::atomic<uint64_t> counter{0};
+            uint64_t seed = reinterpret_cast<uintptr_t>(this) +
+                            counter.fetch_add(1, std::memory_order_relaxed) * 0x9E3779B97F4A7C15ull;
+            seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ull;
+            seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBull;
+            seed ^= seed >> 31;
+            return (seed != 0) ? seed : 1;
+        }
+
+        /// Геометрическое распределение с p = 1/2, xorshift64
+        size_t random_level_() noexcept {
+            random_ ^= random_ << 13;
+            random_ ^= random_ >> 7;
+            random_ ^= random_ << 17;
+            size_t level = 1;
+            uint64_t bits = random_;
+            while (level < kMaxLevel && (bits & 1u)) {
+                ++level;
+                bits >>= 1;
+            }
+            return level;
+        }
+
+        Compare comp_;
+        node_base head_;
+        node_base *head_upper_nodes_[kMaxLevel - 1] = {};
+        node_base tail_;
+        size_t size_ = 0;
+        size_t level_ = 1;
+        uint64_t random_;
+    };
+}
@@ -0,0 +1,402 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace bmstu {
+    /// Список фиксированной ёмкости без обращений к куче: узлы лежат во встроенном массиве
+    /// и связаны индексами, свободные узлы образуют односвязный список.
+    /// Все методы (кроме вывода в поток) constexpr, для тривиально копируемого T
+    /// весь список тривиально копируем и его можно копировать через memcpy.
+    /// T должен конструироваться по умолчанию: все N слотов создаются сразу вместе со списком,
+    /// а освобождённый слот получает T{}, чтобы удалённый элемент ничем не владел
+    template<typename T, size_t N>
+    class static_list {
+        static constexpr size_t npos = static_cast<size_t>(-1);
+        static constexpr size_t head_ = 0;
+        static constexpr size_t tail_ = 1;
+
+        struct node {
+            T value_ = {};
+            size_t next_node = npos;
+            size_t prev_node = npos;
+        };
+
+    public:
+        template<typename value_t>
+        struct list_iterator {
+            friend class static_list;
+
+            template<typename>
+            friend struct list_iterator;
+
+            using iterator_category = std::bidirectional_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = std::remove_const_t<value_t>;
+            using pointer = value_t *;
+            using reference = value_t &;
+            using owner_type = std::conditional_t<std::is_const<value_t>::value, const static_list, static_list>;
+
+            constexpr list_iterator() = default;
+
+            constexpr list_iterator(owner_type *owner, size_t index) : owner_(owner), index_(index) {}
+
+            /// Только iterator -> const_iterator, копирование остаётся неявным
+            template<typename U = value_t, std::enable_if_t<std::is_const<U>::value, int> = 0>
+            constexpr list_iterator(const list_iterator<T> &other) noexcept: owner_(other.owner_), index_(other.index_) {}
+
+            constexpr reference operator*() const {
+                return owner_->nodes_[index_].value_;
+            }
+
+            constexpr pointer operator->() const {
+                return &(owner_->nodes_[index_].value_);
+            }
+
+            constexpr list_iterator &operator++() {
+                if (owner_->nodes_[index_].next_node == npos) {
+                    throw std::logic_error("You can't access the element after tail!");
+                }
+                index_ = owner_->nodes_[index_].next_node;
+                return *this;
+            }
+
+            constexpr list_iterator &operator--() {
+                if (owner_->nodes_[index_].prev_node == npos) {
+                    throw std::logic_error("You can't access the element before head!");
+                }
+                index_ = owner_->nodes_[index_].prev_node;
+                return *this;
+            }
+
+            constexpr list_iterator operator++(int) {
+                list_iterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            constexpr list_iterator operator--(int) {
+                list_iterator tmp = *this;
+                --(*this);
+                return tmp;
+            }
+
+            friend constexpr bool operator==(const list_iterator &a, const list_iterator &b) {
+                return a.owner_ == b.owner_ && a.index_ == b.index_;
+            }
+
+            friend constexpr bool operator!=(const list_iterator &a, const list_iterator &b) {
+                return !(a == b);
+            }
+
+            constexpr list_iterator operator+(const difference_type value) const {
+                list_iterator copy(*this);
+                for (difference_type i = 0; i < value; ++i) {
+                    ++copy;
+                }
+                return copy;
+            }
+
+            constexpr list_iterator operator-(const difference_type value) const {
+                list_iterator copy(*this);
+                for (difference_type i = 0; i < value; ++i) {
+                    --copy;
+                }
+                return copy;
+            }
+
+            constexpr list_iterator &operator+=(const difference_type value) {
+                *this = (*this) + value;
+                return *this;
+            }
+
+            friend constexpr difference_type operator-(const list_iterator &end, const list_iterator &begin) {
+                difference_type result = 0;
+                for (list_iterator copy(begin); copy != end; ++copy) {
+                    ++result;
+                }
+                return result;
+            }
+
+        private:
+            owner_type *owner_ = nullptr;
+            size_t index_ = npos;
+        };
+
+        using value_type = T;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using iterator = list_iterator<T>;
+        using const_iterator = list_iterator<const T>;
+
+        constexpr static_list() {
+            nodes_[head_].next_node = tail_;
+            nodes_[tail_].prev_node = head_;
+            for (size_t i = 2; i < N + 2; ++i) {
+                nodes_[i].next_node = (i + 1 < N + 2) ? i + 1 : npos;
+            }
+            free_ = (N > 0) ? 2 : npos;
+        }
+
+        template<typename it>
+        constexpr static_list(it begin, it end) : static_list() {
+            for (it copy(begin); copy != end; ++copy) {
+                push_back(*copy);
+            }
+        }
+
+        constexpr static_list(std::initializer_list<T> values) : static_list() {
+            for (const auto &val: values) {
+                push_back(val);
+            }
+        }
+
+        template<typename Type>
+        constexpr void push_back(const Type &value) {
+            link_after_(nodes_[tail_].prev_node, acquire_(value));
+        }
+
+        template<typename Type>
+        constexpr void push_front(const Type &value) {
+            link_after_(head_, acquire_(value));
+        }
+
+        constexpr bool empty() const noexcept {
+            return (size_ == 0u);
+        }
+
+        constexpr bool full() const noexcept {
+            return (size_ == N);
+        }
+
+        constexpr size_t size() const noexcept {
+            return size_;
+        }
+
+        static constexpr size_t capacity() noexcept {
+            return N;
+        }
+
+        constexpr void clear() {
+            while (!empty()) {
+                release_(nodes_[head_].next_node);
+            }
+        }
+
+        constexpr void swap(static_list &other) {
+            static_list tmp = *this;
+            *this = other;
+            other = tmp;
+        }
+
+        friend constexpr void swap(static_list &l, static_list &r) {
+            l.swap(r);
+        }
+
+        constexpr iterator begin() noexcept {
+            return iterator{this, nodes_[head_].next_node};
+        }
+
+        constexpr iterator end() noexcept {
+            return iterator{this, tail_};
+        }
+
+        constexpr const_iterator begin() const noexcept {
+            return const_iterator{this, nodes_[head_].next_node};
+        }
+
+        constexpr const_iterator end() const noexcept {
+            return const_iterator{this, tail_};
+        }
+
+        constexpr const_iterator cbegin() const noexcept {
+            return begin();
+        }
+
+        constexpr const_iterator cend() const noexcept {
+            return end();
+        }
+
+        constexpr T operator[](size_t pos) const {
+            return *(begin() + pos);
+        }
+
+        constexpr T &operator[](size_t pos) {
+            return *(begin() + pos);
+        }
+
+        friend constexpr bool operator==(const static_list &l, const static_list &r) {
+            if (l.size_ != r.size_) {
+                return false;
+            }
+            for (auto l_b = l.begin(), r_b = r.begin(); l_b != l.end(); ++l_b, ++r_b) {
+                if (*l_b != *r_b) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        friend constexpr bool operator!=(const static_list &left, const static_list &right) {
+            return !(left == right);
+        }
+
+        friend constexpr bool operator<(const static_list &left, const static_list &right) {
+            auto fl = left.begin(), fr = right.begin();
+            for (; (fl != left.end()) && (fr != right.end()); ++fl, ++fr) {
+                if (*fl < *fr) {
+                    return true;
+                }
+                if (*fr < *fl) {
+                    return false;
+                }
+            }
+            return (fl == left.end()) && (fr != right.end());
+        }
+
+        friend constexpr bool operator>(const static_list &left, const static_list &right) {
+            return (right < left);
+        }
+
+        friend constexpr bool operator<=(const static_list &left, const static_list &right) {
+            return !(right < left);
+        }
+
+        friend constexpr bool operator>=(const static_list &left, const static_list &right) {
+            return !(left < right);
+        }
+
+        friend std::ostream &operator<<(std::ostream &os, const static_list &other) {
+            os << "{";
+            for (auto it = other.begin(); it != other.end(); ++it) {
+                if (it != other.begin()) {
+                    os << ", ";
+                }
+                os << *it;
+            }
+            os << "}";
+            return os;
+        }
+
+        /// Вставка после pos, как в bmstu::list
+        constexpr iterator insert(const_iterator pos, const T &value) {
+            if (pos.index_ == tail_) {
+                throw std::logic_error("You can't insert an element after end");
+            }
+            size_t new_node = acquire_(value);
+            link_after_(pos.index_, new_node);
+            return iterator{this, new_node};
+        }
+
+        /// revers, меняющий только значения (value_), лежащие внутри узлов
+        constexpr void revers_v() {
+            iterator it_b = begin();
+            iterator it_e = end();
+            while (it_b != it_e && it_b != --it_e) {
+                T tmp = *it_b;
+                *it_b = *it_e;
+                *it_e = tmp;
+                ++it_b;
+            }
+        }
+
+        /// revers, меняющий связи между узлами в диапазоне [it_b, it_t)
+        constexpr void revers_n(iterator it_b, iterator it_t) {
+            if (it_b == it_t) {
+                return;
+            }
+            size_t before = nodes_[it_b.index_].prev_node;
+            size_t after = it_t.index_;
+            size_t first = it_b.index_;
+            size_t last = nodes_[after].prev_node;
+            for (size_t current = first; current != after;) {
+                size_t next = nodes_[current].next_node;
+                nodes_[current].next_node = nodes_[current].prev_node;
+                nodes_[current].prev_node = next;
+                current = next;
+            }
+            nodes_[before].next_node = last;
+            nodes_[last].prev_node = before;
+            nodes_[first].next_node = after;
+            nodes_[after].prev_node = first;
+        }
+
+        /// Удаление последнего элемента и возвращение удаленного элемента
+        constexpr T pop() {
+            if (empty()) {
+                throw std::logic_error("List is empty");
+            }
+            size_t to_pop = nodes_[tail_].prev_node;
+            T value = std::move(nodes_[to_pop].value_);
+            release_(to_pop);
+            return value;
+        }
+
+        /// Удаление элементов
+        constexpr void remove(iterator it_b, iterator it_e) {
+            while (it_b != it_e) {
+                size_t current = it_b.index_;
+                ++it_b;
+                release_(current);
+            }
+        }
+
+        /// Оператор "дописи" другого списка к текущему
+        constexpr static_list &operator+=(const static_list &other) {
+            auto it = other.begin();
+            for (size_t i = other.size_; i > 0; --i, ++it) {
+                push_back(*it);
+            }
+            return *this;
+        }
+
+        /// Оператор конкатенации списков
+        friend constexpr static_list operator+(const static_list &left, const static_list &right) {
+            static_list result(left);
+            result += right;
+            return result;
+        }
+
+    private:
+        /// Забирает узел из свободного списка и кладёт в него value
+        template<typename Type>
+        constexpr size_t acquire_(const Type &value) {
+            if (free_ == npos) {
+                throw std::logic_error("static_list is full");
+            }
+            size_t index = free_;
+            free_ = nodes_[index].next_node;
+            nodes_[index].value_ = value;
+            return index;
+        }
+
+        constexpr void link_after_(size_t prev, size_t index) {
+            size_t next = nodes_[prev].next_node;
+            nodes_[index].prev_node = prev;
+            nodes_[index].next_node = next;
+            nodes_[prev].next_node = index;
+            nodes_[next].prev_node = index;
+            ++size_;
+        }
+
+        /// Отвязывает узел и возвращает его в свободный список
+        constexpr void release_(size_t index) {
+            nodes_[nodes_[index].prev_node].next_node = nodes_[index].next_node;
+            nodes_[nodes_[index].next_node].prev_node = nodes_[index].prev_node;
+            nodes_[index].value_ = T{};
+            nodes_[index].prev_node = npos;
+            nodes_[index].next_node = free_;
+            free_ = index;
+            --size_;
+        }
+
+        node nodes_[N + 2] = {};
+        size_t free_ = npos;
+        size_t size_ = 0;
+    };
+}
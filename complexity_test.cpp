@@ -0,0 +1,436 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <map>
+#include <new>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "bmstu_list.h"
+#include "bmstu_sharded_list.h"
+#include "bmstu_sorted_list.h"
+
+/// Счётчик выделений памяти: глобальный operator new подменяется на весь бинарник,
+/// замеры берут только разницу до и после операции. Счётчик свой у каждого потока,
+/// чтобы многопоточные замеры не гоняли общую кэш-линию и не было гонки
+static thread_local std::size_t allocations_count = 0;
+
+void *operator new(std::size_t size) {
+    ++allocations_count;
+    if (void *ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+/// GCC видит free() после встроенного operator new и считает пару несовпадающей,
+/// хотя оба заменены здесь и работают через malloc/free
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+namespace {
+    /// Размеры от 1k до 1M с шагом x4
+    const std::vector<std::size_t> kSizes = {1u << 10, 1u << 12, 1u << 14, 1u << 16, 1u << 18, 1u << 20};
+    /// Число повторов для O(1) операций, чтобы время было измеримым
+    const std::size_t kRepeats = 1u << 14;
+    /// Если один замер дольше этого, большие размеры не меряем (квадратичная операция на 1M не завершится)
+    const double kBudgetSeconds = 0.5;
+
+    /// Файл собирается дважды. С COMPLEXITY_CHECK_TIME проверяется рост времени: он зависит
+    /// от нагрузки машины, поэтому такая сборка помечена меткой complexity. Без него проверяется
+    /// только рост числа выделений памяти - он детерминирован, и эти тесты блокируют CI
+#ifdef COMPLEXITY_CHECK_TIME
+    const bool kCheckTime = true;
+    const int kRuns = 3;
+#else
+    const bool kCheckTime = false;
+    const int kRuns = 1;
+#endif
+
+    volatile long long sink = 0;
+
+    enum class complexity {
+        constant = 0,
+        /// По показателю степени log n неотличим от константы, но на 1M узлов поиск упирается
+        /// в промахи кэша, поэтому для него допуск больше (остаётся строго меньше линейного)
+        logarithmic = 1,
+        linear = 2
+    };
+
+    double exponent_bound(complexity expected) {
+        switch (expected) {
+            case complexity::constant:
+                return 0.5;
+            case complexity::logarithmic:
+                return 0.8;
+            case complexity::linear:
+                return 1.5;
+        }
+        return 0;
+    }
+
+    struct growth {
+        double time = 0;
+        double allocations = 0;
+        std::size_t points = 0;
+    };
+
+    /// Наклон прямой МНК в координатах log(n) / log(y)
+    double fit_exponent(const std::vector<double> &n, const std::vector<double> &y) {
+        double mx = 0, my = 0;
+        for (std::size_t i = 0; i < n.size(); ++i) {
+            mx += std::log(n[i]);
+            my += std::log(y[i]);
+        }
+        mx /= n.size();
+        my /= n.size();
+        double num = 0, den = 0;
+        for (std::size_t i = 0; i < n.size(); ++i) {
+            num += (std::log(n[i]) - mx) * (std::log(y[i]) - my);
+            den += (std::log(n[i]) - mx) * (std::log(n[i]) - mx);
+        }
+        return num / den;
+    }
+
+    /// setup(n) строит состояние вне замера, op(state, n) замеряется (минимум из kRuns прогонов)
+    template<typename Setup, typename Op>
+    growth measure(Setup setup, Op op) {
+        std::vector<double> ns, times, allocs;
+        for (auto n: kSizes) {
+            double best = 0;
+            std::size_t alloc = 0;
+            for (int run = 0; run < kRuns; ++run) {
+                auto state = setup(n);
+                std::size_t before = allocations_count;
+                auto start = std::chrono::steady_clock::now();
+                op(state, n);
+                auto stop = std::chrono::steady_clock::now();
+                alloc = allocations_count - before;
+                double seconds = std::chrono::duration<double>(stop - start).count();
+                best = (run == 0) ? seconds : std::min(best, seconds);
+            }
+            ns.push_back(static_cast<double>(n));
+            times.push_back(std::max(best, 1e-9));
+            allocs.push_back(static_cast<double>(alloc) + 1.0);
+            if (best > kBudgetSeconds) {
+                break;
+            }
+        }
+        growth result;
+        result.points = ns.size();
+        if (ns.size() >= 2) {
+            result.time = fit_exponent(ns, times);
+            result.allocations = fit_exponent(ns, allocs);
+        }
+        return result;
+    }
+
+    template<typename Setup, typename Op>
+    void expect_growth(complexity expected, Setup setup, Op op) {
+        growth result = measure(setup, op);
+        double bound = exponent_bound(expected);
+        if (kCheckTime) {
+            ASSERT_GE(result.points, 3u) << "operation is too slow even on small sizes";
+            EXPECT_LT(result.time, bound) << "time grows as n^" << result.time;
+        } else {
+            ASSERT_GE(result.points, 2u) << "operation is too slow even on small sizes";
+            EXPECT_LT(result.allocations, bound) << "allocations grow as n^" << result.allocations;
+        }
+    }
+
+    bmstu::list<int> make_list(std::size_t n) {
+        bmstu::list<int> result;
+        for (std::size_t i = 0; i < n; ++i) {
+            result.push_back(static_cast<int>(i));
+        }
+        return result;
+    }
+
+    struct list_pair {
+        bmstu::list<int> left;
+        bmstu::list<int> right;
+    };
+
+    list_pair make_pair(std::size_t n) {
+        return list_pair{make_list(n), make_list(n)};
+    }
+}
+
+TEST(Complexity, push_back) {
+    expect_growth(complexity::constant, make_list, [](bmstu::list<int> &l, std::size_t) {
+        for (std::size_t i = 0; i < kRepeats; ++i) {
+            l.push_back(1);
+        }
+    });
+}
+
+TEST(Complexity, push_front) {
+    expect_growth(complexity::constant, make_list, [](bmstu::list<int> &l, std::size_t) {
+        for (std::size_t i = 0; i < kRepeats; ++i) {
+            l.push_front(1);
+        }
+    });
+}
+
+TEST(Complexity, pop) {
+    auto setup = [](std::size_t n) { return make_list(n + kRepeats); };
+    expect_growth(complexity::constant, setup, [](bmstu::list<int> &l, std::size_t) {
+        for (std::size_t i = 0; i < kRepeats; ++i) {
+            sink += l.pop();
+        }
+    });
+}
+
+TEST(Complexity, insert) {
+    expect_growth(complexity::constant, make_list, [](bmstu::list<int> &l, std::size_t) {
+        auto it = l.begin();
+        for (std::size_t i = 0; i < kRepeats; ++i) {
+            it = l.insert(it, 1);
+        }
+    });
+}
+
+TEST(Complexity, iterator_step) {
+    expect_growth(complexity::constant, make_list, [](bmstu::list<int> &l, std::size_t n) {
+        auto it = l.begin();
+        for (std::size_t i = 0; i < kRepeats; ++i) {
+            sink += *it;
+            if (i % n == n - 1) {
+                it = l.begin();
+            } else {
+                ++it;
+            }
+        }
+    });
+}
+
+TEST(Complexity, empty_size_begin_end) {
+    expect_growth(complexity::constant, make_list, [](bmstu::list<int> &l, std::size_t) {
+        for (std::size_t i = 0; i < kRepeats; ++i) {
+            sink += l.size() + l.empty() + (l.begin() != l.end());
+        }
+    });
+}
+
+TEST(Complexity, swap) {
+    expect_growth(complexity::constant, make_pair, [](list_pair &p, std::size_t) {
+        for (std::size_t i = 0; i < kRepeats; ++i) {
+            p.left.swap(p.right);
+        }
+    });
+}
+
+TEST(Complexity, splice_back) {
+    expect_growth(complexity::constant, make_pair, [](list_pair &p, std::size_t) {
+        p.left.splice_back(p.right);
+        p.right.splice_back(p.left);
+    });
+}
+
+TEST(Complexity, copy) {
+    expect_growth(complexity::linear, make_list, [](bmstu::list<int> &l, std::size_t) {
+        bmstu::list<int> copy(l);
+        sink += copy.size();
+    });
+}
+
+TEST(Complexity, copy_assign) {
+    expect_growth(complexity::linear, make_pair, [](list_pair &p, std::size_t) {
+        p.left = p.right;
+    });
+}
+
+TEST(Complexity, range_constructor) {
+    expect_growth(complexity::linear, make_list, [](bmstu::list<int> &l, std::size_t) {
+        bmstu::list<int> copy(l.begin(), l.end());
+        sink += copy.size();
+    });
+}
+
+TEST(Complexity, clear) {
+    expect_growth(complexity::linear, make_list, [](bmstu::list<int> &l, std::size_t) {
+        l.clear();
+    });
+}
+
+TEST(Complexity, remove) {
+    expect_growth(complexity::linear, make_list, [](bmstu::list<int> &l, std::size_t) {
+        l.remove(l.begin(), l.end());
+    });
+}
+
+TEST(Complexity, index) {
+    expect_growth(complexity::linear, make_list, [](bmstu::list<int> &l, std::size_t n) {
+        sink += l[n / 2];
+    });
+}
+
+TEST(Complexity, iterator_advance) {
+    expect_growth(complexity::linear, make_list, [](bmstu::list<int> &l, std::size_t n) {
+        auto it = l.begin();
+        it += static_cast<std::ptrdiff_t>(n / 2);
+        sink += *(it - static_cast<std::ptrdiff_t>(n / 4));
+    });
+}
+
+TEST(Complexity, iterator_distance) {
+    expect_growth(complexity::linear, make_list, [](bmstu::list<int> &l, std::size_t) {
+        sink += l.end() - l.begin();
+    });
+}
+
+TEST(Complexity, compare) {
+    expect_growth(complexity::linear, make_pair, [](list_pair &p, std::size_t) {
+        sink += (p.left == p.right) + (p.left < p.right) + (p.left >= p.right);
+    });
+}
+
+TEST(Complexity, concatenate) {
+    expect_growth(complexity::linear, make_pair, [](list_pair &p, std::size_t) {
+        p.left += p.right;
+        sink += (p.left + p.right).size();
+    });
+}
+
+TEST(Complexity, revers_v) {
+    expect_growth(complexity::linear, make_list, [](bmstu::list<int> &l, std::size_t) {
+        l.revers_v();
+    });
+}
+
+TEST(Complexity, revers_n) {
+    expect_growth(complexity::linear, make_list, [](bmstu::list<int> &l, std::size_t) {
+        l.revers_n(l.begin(), l.end());
+    });
+}
+
+TEST(Complexity, output) {
+    expect_growth(complexity::linear, make_list, [](bmstu::list<int> &l, std::size_t) {
+        std::stringstream ss;
+        ss << l;
+        sink += ss.tellp();
+    });
+}
+
+#ifdef COMPLEXITY_CHECK_TIME
+namespace {
+    /// Лучшее из трёх время, за которое threads_count потоков добавляют по per_thread элементов
+    double sharded_append_seconds(size_t threads_count, size_t per_thread) {
+        double best = 0;
+        for (int run = 0; run < 3; ++run) {
+            bmstu::sharded_list<int> my_list(threads_count);
+            std::vector<std::thread> threads;
+            auto start = std::chrono::steady_clock::now();
+            for (size_t t = 0; t < threads_count; ++t) {
+                threads.emplace_back([&my_list, per_thread] {
+                    for (size_t i = 0; i < per_thread; ++i) {
+                        my_list.push_back(static_cast<int>(i));
+                    }
+                });
+            }
+            for (auto &thread: threads) {
+                thread.join();
+            }
+            auto stop = std::chrono::steady_clock::now();
+            double seconds = std::chrono::duration<double>(stop - start).count();
+            best = (run == 0) ? seconds : std::min(best, seconds);
+        }
+        return best;
+    }
+}
+
+/// При линейном масштабировании k потоков по per_thread добавлений укладываются во время одного
+TEST(Complexity, sharded_append_scaling) {
+    size_t cores = std::min<size_t>(std::thread::hardware_concurrency(), 4);
+    if (cores < 2) {
+        GTEST_SKIP() << "needs at least two cores";
+    }
+    const size_t per_thread = 1u << 18;
+    double single = sharded_append_seconds(1, per_thread);
+    double parallel = sharded_append_seconds(cores, per_thread);
+    EXPECT_LT(parallel, 2 * single) << cores << " threads took " << parallel << "s, one thread " << single << "s";
+}
+#endif
+
+namespace {
+    /// Чётные числа 0..2n, запросы идут случайными числами из того же диапазона
+    /// Построенный список кэшируется, каждому замеру отдаётся копия (копирование линейное)
+    bmstu::sorted_list<int> make_sorted(std::size_t n) {
+        static std::map<std::size_t, bmstu::sorted_list<int>> cache;
+        auto found = cache.find(n);
+        if (found == cache.end()) {
+            bmstu::sorted_list<int> result;
+            for (std::size_t i = 0; i < n; ++i) {
+                result.insert(static_cast<int>(2 * i));
+            }
+            found = cache.emplace(n, std::move(result)).first;
+        }
+        return found->second;
+    }
+}
+
+TEST(Complexity, sorted_insert) {
+    expect_growth(complexity::logarithmic, make_sorted, [](bmstu::sorted_list<int> &l, std::size_t n) {
+        std::minstd_rand gen(1);
+        for (std::size_t i = 0; i < kRepeats; ++i) {
+            l.insert(static_cast<int>(gen() % (2 * n)));
+        }
+    });
+}
+
+TEST(Complexity, sorted_find) {
+    expect_growth(complexity::logarithmic, make_sorted, [](bmstu::sorted_list<int> &l, std::size_t n) {
+        std::minstd_rand gen(2);
+        for (std::size_t i = 0; i < kRepeats; ++i) {
+            sink += (l.find(static_cast<int>(gen() % (2 * n))) != l.end());
+        }
+    });
+}
+
+TEST(Complexity, sorted_bounds) {
+    expect_growth(complexity::logarithmic, make_sorted, [](bmstu::sorted_list<int> &l, std::size_t n) {
+        std::minstd_rand gen(3);
+        for (std::size_t i = 0; i < kRepeats; ++i) {
+            int value = static_cast<int>(gen() % (2 * n));
+            sink += (l.lower_bound(value) != l.upper_bound(value));
+        }
+    });
+}
+
+TEST(Complexity, sorted_erase) {
+    auto setup = [](std::size_t n) { return make_sorted(n + kRepeats); };
+    expect_growth(complexity::logarithmic, setup, [](bmstu::sorted_list<int> &l, std::size_t n) {
+        std::minstd_rand gen(4);
+        for (std::size_t i = 0; i < kRepeats; ++i) {
+            auto it = l.lower_bound(static_cast<int>(gen() % (2 * (n + kRepeats))));
+            if (it != l.end()) {
+                l.erase(it);
+            }
+        }
+    });
+}
+
+TEST(Complexity, sorted_copy) {
+    expect_growth(complexity::linear, make_sorted, [](bmstu::sorted_list<int> &l, std::size_t) {
+        bmstu::sorted_list<int> copy(l);
+        sink += copy.size();
+    });
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include "bmstu_list.h"
+
+namespace {
+    void expect_same(bmstu::list<int> &actual, const std::list<int> &expected) {
+        ASSERT_EQ(actual.size(), expected.size());
+        ASSERT_TRUE(std::equal(expected.begin(), expected.end(), actual.begin()));
+    }
+}
+
+
+TEST(Differential, RandomOperations) {
+    std::mt19937 gen(20231018);
+    for (int round = 0; round < 20; ++round) {
+        bmstu::list<int> actual;
+        std::list<int> expected;
+        for (int step = 0; step < 2000; ++step) {
+            int value = static_cast<int>(gen() % 1000);
+            std::size_t size = expected.size();
+            switch (gen() % 14) {
+                case 0:
+                case 1:
+                    actual.push_back(value);
+                    expected.push_back(value);
+                    break;
+                case 2:
+                case 3:
+                    actual.push_front(value);
+                    expected.push_front(value);
+                    break;
+                case 4:
+                    if (size == 0) {
+                        ASSERT_THROW(actual.pop(), std::logic_error);
+                    } else {
+                        ASSERT_EQ(actual.pop(), expected.back());
+                        expected.pop_back();
+                    }
+                    break;
+                case 5: {
+                    /// insert вставляет после pos, поэтому начинаем с head
+                    std::size_t pos = gen() % (size + 1);
+                    actual.insert(actual.begin() - 1 + pos, value);
+                    expected.insert(std::next(expected.begin(), pos), value);
+                    break;
+                }
+                case 6: {
+                    std::size_t from = gen() % (size + 1);
+                    std::size_t to = from + gen() % (size - from + 1);
+                    actual.remove(actual.begin() + from, actual.begin() + to);
+                    expected.erase(std::next(expected.begin(), from), std::next(expected.begin(), to));
+                    break;
+                }
+                case 7:
+                    actual.revers_v();
+                    expected.reverse();
+                    break;
+                case 8:
+                    actual.revers_n(actual.begin(), actual.end());
+                    expected.reverse();
+                    break;
+                case 9:
+                    if (size != 0) {
+                        std::size_t pos = gen() % size;
+                        actual[pos] = value;
+                        *std::next(expected.begin(), pos) = value;
+                    }
+                    break;
+                case 10: {
+                    bmstu::list<int> copy(actual);
+                    ASSERT_TRUE(copy == actual);
+                    ASSERT_EQ(actual.end() - actual.begin(), static_cast<std::ptrdiff_t>(size));
+                    if (size < 100) {
+                        std::list<int> expected_copy(expected);
+                        actual += copy;
+                        expected.splice(expected.end(), expected_copy);
+                    }
+                    break;
+                }
+                case 12: {
+                    /// Префикс текущего списка, иногда с изменённым или добавленным хвостом,
+                    /// чтобы сравнения расходились не только на первом элементе
+                    std::list<int> expected_other(expected.begin(), std::next(expected.begin(), gen() % (size + 1)));
+                    if (!expected_other.empty() && gen() % 2 == 0) {
+                        expected_other.back() += static_cast<int>(gen() % 3) - 1;
+                    }
+                    if (gen() % 2 == 0) {
+                        expected_other.push_back(value);
+                    }
+                    bmstu::list<int> other(expected_other.begin(), expected_other.end());
+                    expect_same(other, expected_other);
+                    ASSERT_EQ(actual == other, expected == expected_other);
+                    ASSERT_EQ(actual != other, expected != expected_other);
+                    ASSERT_EQ(actual < other, expected < expected_other);
+                    ASSERT_EQ(actual > other, expected > expected_other);
+                    ASSERT_EQ(actual <= other, expected <= expected_other);
+                    ASSERT_EQ(actual >= other, expected >= expected_other);
+                    ASSERT_EQ(actual < actual, expected < expected);
+                    ASSERT_EQ(actual <= actual, expected <= expected);
+                    if (size < 100) {
+                        actual = actual + other;
+                        expected.insert(expected.end(), expected_other.begin(), expected_other.end());
+                    }
+                    break;
+                }
+                case 13: {
+                    bmstu::list<int> small({value, value + 1, value - 1});
+                    expect_same(small, std::list<int>({value, value + 1, value - 1}));
+                    bmstu::list<int> assigned(small);
+                    assigned = actual;
+                    expect_same(assigned, expected);
+                    if (gen() % 4 == 0) {
+                        actual = small;
+                        expected = {value, value + 1, value - 1};
+                    }
+                    break;
+                }
+                case 11:
+                    if (gen() % 10 == 0) {
+                        actual.clear();
+                        expected.clear();
+                    }
+                    break;
+            }
+            expect_same(actual, expected);
+        }
+        std::stringstream actual_ss, expected_ss;
+        actual_ss << actual;
+        expected_ss << "{";
+        for (auto it = expected.begin(); it != expected.end(); ++it) {
+            expected_ss << (it == expected.begin() ? "" : ", ") << *it;
+        }
+        expected_ss << "}";
+        ASSERT_EQ(actual_ss.str(), expected_ss.str());
+    }
+}
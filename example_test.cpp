@@ -240,6 +240,16 @@ TEST(Operator, EQs) {
     ASSERT_TRUE(my_list_5 >= my_list_1);
 }
 
+TEST(Operator, Less) {
+    bmstu::list<int> my_list_1({1, 2});
+    bmstu::list<int> my_list_2({1, 2, 3});
+
+    ASSERT_TRUE(my_list_1 < my_list_2);
+    ASSERT_FALSE(my_list_2 < my_list_1);
+    ASSERT_FALSE(my_list_1 < my_list_1);
+    ASSERT_TRUE(my_list_1 <= my_list_1);
+}
+
 TEST(Operator, LeftShift) {
     bmstu::list<int> my_list({0, 1, 2, 3, 4, 5, 6});
     std::stringstream ss;
@@ -269,4 +279,33 @@ TEST(Method, insert) {
         ASSERT_TRUE(*it_e == a);
         ASSERT_TRUE(my_list[a] == a);
     }
-}
\ No newline at end of file
+}
+
+TEST(Method, splice_back) {
+    bmstu::list<int> my_list_1({0, 1, 2});
+    bmstu::list<int> my_list_2({3, 4});
+
+    my_list_1.splice_back(my_list_2);
+
+    ASSERT_EQ(my_list_1.size(), 5);
+    ASSERT_EQ(my_list_2.size(), 0);
+    ASSERT_TRUE(my_list_2.begin() == my_list_2.end());
+
+    bmstu::list<int>::iterator it_b = my_list_1.begin();
+    bmstu::list<int>::iterator it_e = my_list_1.end();
+    for (int a = 0; it_b != it_e; ++it_b, ++a) {
+        ASSERT_TRUE(*it_b == a);
+    }
+
+    --it_e;
+    it_b = my_list_1.begin() - 1;
+    for (int a = 4; it_b != it_e; --it_e, --a) {
+        ASSERT_TRUE(*it_e == a);
+    }
+
+    my_list_2.push_back(5);
+    my_list_2.splice_back(my_list_1);
+    ASSERT_EQ(my_list_2.size(), 6);
+    ASSERT_EQ(my_list_2[0], 5);
+    ASSERT_EQ(my_list_2[5], 4);
+}
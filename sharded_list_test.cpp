@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "bmstu_sharded_list.h"
+
+TEST(ShardedList, Default) {
+    bmstu::sharded_list<int> my_list(4);
+
+    ASSERT_EQ(my_list.shards(), 4);
+    ASSERT_EQ(my_list.size(), 0);
+    ASSERT_TRUE(my_list.empty());
+    ASSERT_EQ(my_list.collect().size(), 0);
+}
+
+TEST(ShardedList, PushBackFromThreads) {
+    const int threads_count = 8;
+    const int per_thread = 10000;
+    bmstu::sharded_list<int> my_list(4);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t) {
+        threads.emplace_back([&my_list, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                my_list.push_back(t * per_thread + i);
+            }
+        });
+    }
+    for (auto &thread: threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(my_list.size(), threads_count * per_thread);
+
+    bmstu::list<int> collected = my_list.collect();
+    ASSERT_EQ(collected.size(), threads_count * per_thread);
+    ASSERT_TRUE(my_list.empty());
+
+    std::vector<int> seen(threads_count * per_thread, 0);
+    for (auto &item: collected) {
+        ++seen[item];
+    }
+    for (auto count: seen) {
+        ASSERT_EQ(count, 1);
+    }
+}
+
+TEST(ShardedList, ForEach) {
+    bmstu::sharded_list<int> my_list(3);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 3; ++t) {
+        threads.emplace_back([&my_list] {
+            for (int i = 1; i <= 100; ++i) {
+                my_list.push_back(i);
+            }
+        });
+    }
+    for (auto &thread: threads) {
+        thread.join();
+    }
+
+    std::atomic<int> sum{0};
+    my_list.for_each([&sum](int &item) {
+        sum += item;
+        item = 0;
+    });
+    ASSERT_EQ(sum, 3 * 5050);
+
+    sum = 0;
+    my_list.for_each([&sum](int item) { sum += item; });
+    ASSERT_EQ(sum, 0);
+    ASSERT_EQ(my_list.size(), 300);
+}
+
+TEST(ShardedList, ForEachRethrows) {
+    bmstu::sharded_list<int> my_list(2);
+    my_list.push_back(1);
+    ASSERT_THROW(my_list.for_each([](int) { throw std::logic_error("stop"); }), std::logic_error);
+}
+
+/// Единственный непустой шард не нулевой, но обходится в вызывающем потоке
+TEST(ShardedList, ForEachSkipsEmptyShards) {
+    bmstu::sharded_list<int> my_list(8);
+    std::atomic<bool> pushed{false};
+    std::thread first([&my_list, &pushed] {
+        my_list.push_back(0);
+        while (!pushed) {
+            std::this_thread::yield();
+        }
+    });
+    while (my_list.empty()) {
+        std::this_thread::yield();
+    }
+    my_list.push_back(0);
+    pushed = true;
+    first.join();
+    my_list.clear();
+    my_list.push_back(1);
+    my_list.push_back(2);
+
+    std::vector<std::thread::id> visitors;
+    my_list.for_each([&visitors](int) { visitors.push_back(std::this_thread::get_id()); });
+    ASSERT_EQ(visitors.size(), 2);
+    ASSERT_EQ(visitors[0], std::this_thread::get_id());
+    ASSERT_EQ(visitors[1], std::this_thread::get_id());
+
+    bmstu::sharded_list<int> empty_list(8);
+    empty_list.for_each([](int) { FAIL(); });
+}
+
+TEST(ShardedList, Clear) {
+    bmstu::sharded_list<int> my_list(2);
+    my_list.push_back(1);
+    my_list.push_back(2);
+    my_list.clear();
+    ASSERT_TRUE(my_list.empty());
+}
+
+namespace {
+    /// Потоки живут, пока все не добавят свой элемент
+    void push_concurrently(bmstu::sharded_list<int> &my_list, const std::vector<int> &values) {
+        std::atomic<size_t> arrived{0};
+        std::vector<std::thread> threads;
+        for (auto value: values) {
+            threads.emplace_back([&my_list, &arrived, &values, value] {
+                my_list.push_back(value);
+                ++arrived;
+                while (arrived < values.size()) {
+                    std::this_thread::yield();
+                }
+            });
+        }
+        for (auto &thread: threads) {
+            thread.join();
+        }
+    }
+}
+
+TEST(ShardedList, LiveThreadsGetOwnShards) {
+    bmstu::sharded_list<int> my_list(4);
+
+    /// Долгоживущий поток и пул, который пересоздаётся: номера потоков растут,
+    /// но шарды завершившихся потоков возвращаются и выдаются заново
+    std::atomic<bool> stop{false};
+    std::atomic<bool> pushed{false};
+    std::thread long_lived([&] {
+        my_list.push_back(0);
+        pushed = true;
+        while (!stop) {
+            std::this_thread::yield();
+        }
+    });
+    while (!pushed) {
+        std::this_thread::yield();
+    }
+    push_concurrently(my_list, {100, 100, 100});
+    push_concurrently(my_list, {1, 2, 3});
+    stop = true;
+    long_lived.join();
+
+    /// for_each обходит каждый шард в отдельном потоке: группировка по потоку = группировка по шарду
+    std::mutex mutex;
+    std::map<std::thread::id, std::vector<int>> by_shard;
+    my_list.for_each([&](int item) {
+        std::lock_guard<std::mutex> lock(mutex);
+        by_shard[std::this_thread::get_id()].push_back(item);
+    });
+    ASSERT_EQ(by_shard.size(), 4);
+    for (const auto &shard: by_shard) {
+        ASSERT_EQ(std::count_if(shard.second.begin(), shard.second.end(), [](int item) { return item != 100; }), 1);
+    }
+}
@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <set>
+#include <sstream>
+#include <type_traits>
+#include "bmstu_sorted_list.h"
+
+static_assert(std::is_nothrow_move_constructible<bmstu::sorted_list<int>>::value, "");
+static_assert(std::is_nothrow_move_assignable<bmstu::sorted_list<int>>::value, "");
+
+TEST(SortedList, Default) {
+    bmstu::sorted_list<int> my_list;
+    bmstu::sorted_list<int>::iterator it_b = my_list.begin();
+    bmstu::sorted_list<int>::iterator it_e = my_list.end();
+
+    ASSERT_EQ(my_list.size(), 0);
+    ASSERT_TRUE(it_b == it_e);
+    ASSERT_TRUE(my_list.find(1) == my_list.end());
+
+    --it_b;
+    --it_e;
+    ASSERT_TRUE(it_b == it_e);
+}
+
+TEST(SortedList, IList) {
+    bmstu::sorted_list<int> my_list({3, 0, 4, 1, 2});
+    bmstu::sorted_list<int>::iterator it_b = my_list.begin();
+    bmstu::sorted_list<int>::iterator it_e = my_list.end();
+
+    ASSERT_EQ(my_list.size(), 5);
+    for (int a = 0; it_b != it_e; ++it_b, ++a) {
+        ASSERT_TRUE(*it_b == a);
+    }
+
+    --it_e;
+    it_b = my_list.begin();
+    --it_b;
+    for (int a = 4; it_b != it_e; --it_e, --a) {
+        ASSERT_TRUE(*it_e == a);
+    }
+}
+
+TEST(SortedList, Compare) {
+    bmstu::sorted_list<int, std::greater<int>> my_list({3, 0, 4, 1, 2});
+    std::stringstream ss;
+    ss << my_list;
+    ASSERT_STREQ(ss.str().c_str(), "{4, 3, 2, 1, 0}");
+}
+
+TEST(SortedList, Bounds) {
+    bmstu::sorted_list<int> my_list({1, 3, 3, 3, 5});
+
+    ASSERT_EQ(*my_list.lower_bound(3), 3);
+    ASSERT_EQ(*my_list.upper_bound(3), 5);
+    ASSERT_EQ(*my_list.lower_bound(2), 3);
+    ASSERT_EQ(*my_list.lower_bound(0), 1);
+    ASSERT_TRUE(my_list.lower_bound(6) == my_list.end());
+    ASSERT_TRUE(my_list.upper_bound(5) == my_list.end());
+
+    auto it = my_list.lower_bound(3);
+    ++it;
+    ++it;
+    ++it;
+    ASSERT_TRUE(it == my_list.upper_bound(3));
+    ASSERT_TRUE(my_list.contains(5));
+    ASSERT_FALSE(my_list.contains(4));
+}
+
+TEST(SortedList, Erase) {
+    bmstu::sorted_list<int> my_list({1, 3, 3, 3, 5, 7});
+
+    ASSERT_EQ(my_list.erase(3), 3);
+    ASSERT_EQ(my_list.erase(4), 0);
+    ASSERT_EQ(my_list.size(), 3);
+
+    auto it = my_list.erase(my_list.find(5));
+    ASSERT_EQ(*it, 7);
+    ASSERT_THROW(my_list.erase(my_list.end()), std::logic_error);
+
+    my_list.insert(6);
+    my_list.remove(my_list.begin(), my_list.lower_bound(7));
+    ASSERT_TRUE(my_list == bmstu::sorted_list<int>({7}));
+}
+
+TEST(SortedList, Copy) {
+    bmstu::sorted_list<int> my_list_1({5, 4, 3, 2, 1});
+    bmstu::sorted_list<int> my_list_2(my_list_1);
+
+    ASSERT_TRUE(my_list_1 == my_list_2);
+    my_list_2.insert(0);
+    ASSERT_TRUE(my_list_1 != my_list_2);
+    ASSERT_EQ(*my_list_2.begin(), 0);
+    ASSERT_EQ(*my_list_2.find(3), 3);
+
+    bmstu::sorted_list<int> my_list_3(std::move(my_list_2));
+    ASSERT_EQ(my_list_2.size(), 0);
+    ASSERT_EQ(my_list_3.size(), 6);
+
+    my_list_2 = my_list_3;
+    ASSERT_TRUE(my_list_2 == my_list_3);
+}
+
+TEST(SortedList, Differential) {
+    std::mt19937 gen(20231018);
+    bmstu::sorted_list<int> actual;
+    std::multiset<int> expected;
+    for (int step = 0; step < 20000; ++step) {
+        int value = static_cast<int>(gen() % 500);
+        switch (gen() % 4) {
+            case 0:
+            case 1:
+                actual.insert(value);
+                expected.insert(value);
+                break;
+            case 2:
+                ASSERT_EQ(actual.erase(value), expected.erase(value));
+                break;
+            case 3: {
+                auto it = actual.find(value);
+                auto expected_it = expected.find(value);
+                ASSERT_EQ(it == actual.end(), expected_it == expected.end());
+                if (it != actual.end()) {
+                    actual.erase(it);
+                    expected.erase(expected_it);
+                }
+                break;
+            }
+        }
+        ASSERT_EQ(actual.size(), expected.size());
+        auto lb = actual.lower_bound(value);
+        auto expected_lb = expected.lower_bound(value);
+        ASSERT_EQ(lb == actual.end(), expected_lb == expected.end());
+        if (lb != actual.end()) {
+            ASSERT_EQ(*lb, *expected_lb);
+        }
+    }
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), actual.begin()));
+}
+
+TEST(SortedList, Move) {
+    bmstu::sorted_list<int> my_list_1;
+    for (int a = 0; a < 1000; ++a) {
+        my_list_1.insert((a * 7) % 1000);
+    }
+
+    bmstu::sorted_list<int> my_list_2(std::move(my_list_1));
+    ASSERT_TRUE(my_list_1.empty());
+    ASSERT_TRUE(my_list_1.begin() == my_list_1.end());
+    ASSERT_EQ(my_list_2.size(), 1000);
+
+    my_list_1.insert(5);
+    ASSERT_EQ(*my_list_1.find(5), 5);
+
+    my_list_1 = std::move(my_list_2);
+    ASSERT_EQ(my_list_1.size(), 1000);
+    ASSERT_EQ(my_list_2.size(), 0);
+    auto it = my_list_1.end();
+    for (int a = 999; a >= 0; --a) {
+        --it;
+        ASSERT_EQ(*it, a);
+        ASSERT_EQ(*my_list_1.find(a), a);
+    }
+    ASSERT_EQ(my_list_1.erase(999), 1);
+    ASSERT_EQ(*(--my_list_1.end()), 998);
+
+    bmstu::sorted_list<int> my_list_3({1, 2});
+    my_list_3.swap(my_list_1);
+    ASSERT_EQ(my_list_3.size(), 999);
+    ASSERT_TRUE(my_list_1 == bmstu::sorted_list<int>({1, 2}));
+}
+
+namespace {
+    struct no_default {
+        explicit no_default(int value) : value_(value) {}
+
+        bool operator<(const no_default &other) const {
+            return value_ < other.value_;
+        }
+
+        int value_;
+    };
+}
+
+TEST(SortedList, NoDefaultConstructor) {
+    bmstu::sorted_list<no_default> my_list;
+    for (int value: {3, 1, 2}) {
+        my_list.insert(no_default(value));
+    }
+    bmstu::sorted_list<no_default> copy(my_list);
+    my_list.erase(no_default(2));
+
+    ASSERT_EQ(my_list.size(), 2);
+    ASSERT_EQ(my_list.begin()->value_, 1);
+    ASSERT_EQ(copy.size(), 3);
+    ASSERT_EQ((++copy.begin())->value_, 2);
+}
+
+namespace {
+    struct alignas(64) wide {
+        bool operator<(const wide &other) const {
+            return value_ < other.value_;
+        }
+
+        int value_;
+    };
+}
+
+TEST(SortedList, OverAligned) {
+    bmstu::sorted_list<wide> my_list;
+    for (int value = 0; value < 100; ++value) {
+        my_list.insert(wide{(value * 37) % 100});
+    }
+    bmstu::sorted_list<wide> copy(my_list);
+
+    int expected = 0;
+    for (const auto &item: copy) {
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(&item) % alignof(wide), 0u);
+        ASSERT_EQ(item.value_, expected++);
+    }
+    ASSERT_EQ(expected, 100);
+}
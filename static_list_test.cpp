@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <type_traits>
+#include "bmstu_static_list.h"
+
+namespace {
+    using list_8 = bmstu::static_list<int, 8>;
+
+    constexpr bmstu::static_list<int, 8> make_lookup() {
+        bmstu::static_list<int, 8> result({1, 2, 4});
+        result.push_front(0);
+        result.insert(result.begin() + 2, 3);
+        result.push_back(5);
+        result.pop();
+        return result;
+    }
+
+    constexpr bmstu::static_list<int, 8> kLookup = make_lookup();
+
+    constexpr bmstu::static_list<int, 8> make_reversed() {
+        bmstu::static_list<int, 8> result = kLookup;
+        result.revers_n(result.begin(), result.end());
+        return result;
+    }
+}
+
+static_assert(std::is_trivially_copyable<bmstu::static_list<int, 8>>::value, "static_list must be memcpy-able");
+static_assert(kLookup.size() == 5, "");
+static_assert(kLookup[0] == 0 && kLookup[2] == 2 && kLookup[3] == 3 && kLookup[4] == 4, "");
+static_assert(make_reversed() == list_8({4, 3, 2, 1, 0}), "");
+static_assert(bmstu::static_list<int, 8>({1, 2}) < bmstu::static_list<int, 8>({1, 2, 3}), "");
+
+TEST(StaticList, Default) {
+    bmstu::static_list<int, 4> my_list;
+    bmstu::static_list<int, 4>::iterator it_b = my_list.begin();
+    bmstu::static_list<int, 4>::iterator it_e = my_list.end();
+
+    ASSERT_EQ(my_list.size(), 0);
+    ASSERT_EQ(my_list.capacity(), 4);
+    ASSERT_TRUE(it_b == it_e);
+
+    --it_b;
+    --it_e;
+    ASSERT_TRUE(it_b == it_e);
+}
+
+TEST(StaticList, Constexpr) {
+    bmstu::static_list<int, 8> my_list = kLookup;
+    bmstu::static_list<int, 8>::iterator it_b = my_list.begin();
+    bmstu::static_list<int, 8>::iterator it_e = my_list.end();
+
+    for (int a = 0; it_b != it_e; ++it_b, ++a) {
+        ASSERT_TRUE(*it_b == a);
+        ASSERT_TRUE(my_list[a] == a);
+    }
+
+    --it_e;
+    it_b = my_list.begin() - 1;
+    for (int a = 4; it_b != it_e; --it_e, --a) {
+        ASSERT_TRUE(*it_e == a);
+    }
+}
+
+TEST(StaticList, Memcpy) {
+    bmstu::static_list<int, 8> my_list_1 = kLookup;
+    bmstu::static_list<int, 8> my_list_2;
+    std::memcpy(&my_list_2, &my_list_1, sizeof(my_list_1));
+
+    ASSERT_TRUE(my_list_1 == my_list_2);
+    my_list_2.push_back(5);
+    ASSERT_EQ(my_list_1.size(), 5);
+    ASSERT_EQ(my_list_2.size(), 6);
+    ASSERT_EQ(my_list_2[5], 5);
+}
+
+TEST(StaticList, Full) {
+    bmstu::static_list<int, 3> my_list({0, 1, 2});
+
+    ASSERT_TRUE(my_list.full());
+    ASSERT_THROW(my_list.push_back(3), std::logic_error);
+    ASSERT_THROW(my_list.push_front(3), std::logic_error);
+
+    ASSERT_EQ(my_list.pop(), 2);
+    my_list.push_front(3);
+    std::stringstream ss;
+    ss << my_list;
+    ASSERT_STREQ(ss.str().c_str(), "{3, 0, 1}");
+}
+
+TEST(StaticList, Remove) {
+    bmstu::static_list<int, 8> my_list({0, 1, 2, 3, 4, 5});
+
+    my_list.remove(my_list.begin() + 1, my_list.begin() + 4);
+
+    ASSERT_EQ(my_list.size(), 3);
+    ASSERT_TRUE(my_list == list_8({0, 4, 5}));
+
+    for (int a = 0; a < 5; ++a) {
+        my_list.push_back(a);
+    }
+    ASSERT_TRUE(my_list.full());
+
+    my_list.clear();
+    ASSERT_TRUE(my_list.empty());
+    ASSERT_THROW(my_list.pop(), std::logic_error);
+}
+
+TEST(StaticList, Revers) {
+    bmstu::static_list<int, 8> my_list({0, 1, 2, 3, 4, 5});
+
+    my_list.revers_v();
+    ASSERT_TRUE(my_list == list_8({5, 4, 3, 2, 1, 0}));
+
+    my_list.revers_n(my_list.begin() + 1, my_list.end() - 1);
+    ASSERT_TRUE(my_list == list_8({5, 1, 2, 3, 4, 0}));
+}
+
+TEST(StaticList, Insert) {
+    bmstu::static_list<int, 8> my_list({0, 1, 2, 4});
+    bmstu::static_list<int, 8>::iterator it = my_list.end();
+    ASSERT_THROW(my_list.insert(it, 5), std::logic_error);
+
+    it = it - 2;
+    my_list.insert(it, 3);
+    ASSERT_TRUE(my_list == list_8({0, 1, 2, 3, 4}));
+    ASSERT_EQ(my_list.end() - my_list.begin(), 5);
+}
+
+TEST(StaticList, Concatenate) {
+    bmstu::static_list<int, 8> my_list_1({0, 1, 2});
+    bmstu::static_list<int, 8> my_list_2({3, 4});
+
+    ASSERT_TRUE(my_list_1 + my_list_2 == list_8({0, 1, 2, 3, 4}));
+
+    my_list_1.swap(my_list_2);
+    ASSERT_TRUE(my_list_1 == list_8({3, 4}));
+    ASSERT_TRUE(my_list_1 > my_list_2);
+}
+
+TEST(StaticList, ReleasesValues) {
+    auto value = std::make_shared<int>(1);
+    bmstu::static_list<std::shared_ptr<int>, 4> my_list;
+
+    my_list.push_back(value);
+    ASSERT_EQ(value.use_count(), 2);
+    ASSERT_EQ(*my_list.pop(), 1);
+    ASSERT_EQ(value.use_count(), 1);
+
+    my_list.push_back(value);
+    my_list.push_front(value);
+    my_list.remove(my_list.begin(), my_list.begin() + 1);
+    ASSERT_EQ(value.use_count(), 2);
+
+    my_list.clear();
+    ASSERT_EQ(value.use_count(), 1);
+}